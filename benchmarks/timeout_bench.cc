@@ -0,0 +1,165 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2023-2028, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the Cheetah nor the
+names of its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <Cheetah/TimerEngine.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace hmta;
+using namespace std::chrono;
+
+// ----------------------------------------------------------------------------
+
+using engine_type = TimerEngine<>;
+
+static std::atomic<size_t>  fired { 0 };
+
+// ----------------------------------------------------------------------------
+
+static void report(const char *name, size_t ops, steady_clock::duration d)  {
+
+    const double    secs = duration<double>(d).count();
+
+    std::cout << name << ": " << ops << " create/cancel pairs in "
+              << secs << " secs, " << size_t(double(ops) / secs)
+              << " pairs/sec" << std::endl;
+}
+
+// ----------------------------------------------------------------------------
+
+// Create a timeout and cancel it right away, like a request that finishes
+// well before its deadline.
+//
+static void bench_schedule_cancel(engine_type &engine, size_t n)  {
+
+    const auto  start = steady_clock::now();
+
+    for (size_t i = 0; i < n; ++i)  {
+        auto    handle =
+            engine.schedule_after(seconds(30),
+                                  [i]() -> void { fired += i; });
+
+        handle.cancel();
+    }
+    report("schedule_after()/cancel() back to back", n,
+           steady_clock::now() - start);
+}
+
+// ----------------------------------------------------------------------------
+
+// Keep many timeouts outstanding, then cancel all of them.
+//
+static void bench_outstanding(engine_type &engine, size_t n)  {
+
+    std::vector<engine_type::TimerHandle>   handles;
+
+    handles.reserve(n);
+
+    const auto  start = steady_clock::now();
+
+    for (size_t i = 0; i < n; ++i)
+        handles.push_back(
+            engine.schedule_after(milliseconds(1000 + i % 30000),
+                                  [i]() -> void { fired += i; }));
+    for (auto &handle : handles)
+        handle.cancel();
+    report("schedule_after()/cancel() outstanding", n,
+           steady_clock::now() - start);
+}
+
+// ----------------------------------------------------------------------------
+
+static void bench_threads(engine_type &engine, size_t n, size_t thr_count)  {
+
+    std::vector<std::thread>    threads;
+    const auto                  start = steady_clock::now();
+
+    for (size_t t = 0; t < thr_count; ++t)
+        threads.emplace_back([&engine, n, thr_count]() -> void  {
+            for (size_t i = 0; i < n / thr_count; ++i)  {
+                auto    handle =
+                    engine.schedule_after(seconds(30),
+                                          [i]() -> void { fired += i; });
+
+                handle.cancel();
+            }
+        });
+    for (auto &thr : threads)
+        thr.join();
+    report("schedule_after()/cancel() from threads", n,
+           steady_clock::now() - start);
+}
+
+// ----------------------------------------------------------------------------
+
+// For comparison, the same with the general purpose timers
+//
+static void bench_add_remove(engine_type &engine, size_t n)  {
+
+    const auto  start = steady_clock::now();
+
+    for (size_t i = 0; i < n; ++i)  {
+        const auto  id =
+            engine.add_timer([i]() -> void { fired += i; }, seconds(30),
+                             seconds(0), 1);
+
+        engine.remove_timer(id);
+    }
+    report("add_timer()/remove_timer() back to back", n,
+           steady_clock::now() - start);
+}
+
+// ----------------------------------------------------------------------------
+
+int main(int, char *[])  {
+
+    constexpr size_t    n = 2000000;
+    engine_type         engine;
+
+    bench_schedule_cancel(engine, n);
+    bench_outstanding(engine, n / 10);
+    bench_threads(engine, n, 4);
+    bench_add_remove(engine, n);
+
+    if (engine.timeout_count() != 0 || fired != 0)  return (EXIT_FAILURE);
+    return (EXIT_SUCCESS);
+}
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
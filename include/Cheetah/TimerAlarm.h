@@ -29,6 +29,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <Cheetah/TimerEngine.h>
+
 #include <atomic>
 #include <concepts>
 #include <condition_variable>
@@ -42,7 +44,7 @@ namespace hmta
 {
 
 // F must define the operator()() which will be executed on either
-// the engine_routine thread.
+// the engine_routine thread or the TimerEngine thread.
 //
 template<std::invocable F>
 class   TimerAlarm  {
@@ -71,6 +73,23 @@ public:
                //
                size_type repeat_count = FOREVER);
 
+    // The timer is created in disarmed state. Once armed, it runs on the
+    // engine thread instead of a thread of its own. It may go off up to
+    // the slack late, so it could share a wakeup with other timers.
+    // The engine must outlive the timer, because disarm() and the
+    // destructor remove the timer from the engine.
+    //
+    TimerAlarm(F &functor,
+               TimerEngine<> &engine,
+               time_type interval_sec,
+               time_type interval_nanosec = 0,
+               size_type repeat_count = FOREVER,
+
+               // Slack in seconds and nano-seconds
+               //
+               time_type slack_sec = 0,
+               time_type slack_nanosec = 0);
+
     // It must wait for the engine_routine() to finish.
     //
     ~TimerAlarm() noexcept;
@@ -89,8 +108,13 @@ public:
 
 private:
 
+    using engine_type = TimerEngine<>;
+
     bool engine_routine_() noexcept;
 
+    static engine_type::duration_type
+    to_duration_(time_type sec, time_type nanosec) noexcept;
+
     std::atomic_bool        is_armed_ { false };
     size_type               repeated_sofar_ { 0 };
 
@@ -100,6 +124,11 @@ private:
 
     F                       &functor_;
 
+    engine_type             *engine_ { nullptr };
+    engine_type::id_type    engine_id_ { 0 };
+    time_type               slack_sec_ { 0 };
+    time_type               slack_nanosec_ { 0 };
+
     mutable std::mutex      state_mutex_ { };
     std::condition_variable engine_cv_ { };
 };
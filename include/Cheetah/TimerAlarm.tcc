@@ -61,9 +61,47 @@ TimerAlarm<F>::TimerAlarm(F &functor,
 
 // ----------------------------------------------------------------------------
 
+template<std::invocable F>
+TimerAlarm<F>::TimerAlarm(F &functor,
+                          TimerEngine<> &engine,
+                          time_type interval_sec,
+                          time_type interval_nanosec,
+                          size_type repeat_count,
+                          time_type slack_sec,
+                          time_type slack_nanosec)
+    : TimerAlarm(functor, interval_sec, interval_nanosec, repeat_count)  {
+
+    if (slack_sec < 0 || slack_nanosec < 0)
+        throw std::runtime_error { "TimerAlarm::TimerAlarm(): "
+                                   "the slack must not be negative." };
+
+    // The engine takes the seconds and nano-seconds together. So fail
+    // here, not in arm().
+    //
+    if (to_duration_(interval_sec, interval_nanosec) <=
+            engine_type::duration_type::zero())
+        throw std::runtime_error { "TimerAlarm::TimerAlarm(): "
+                                   "the time interval must be greater then "
+                                   "zero nano seconds." };
+
+    engine_ = &engine;
+    slack_sec_ = slack_sec;
+    slack_nanosec_ = slack_nanosec;
+}
+
+// ----------------------------------------------------------------------------
+
 template<std::invocable F>
 TimerAlarm<F>::~TimerAlarm() noexcept  {
 
+    // The engine waits for our functor, if it is running right now.
+    //
+    if (engine_)  {
+        is_armed_.store(false, std::memory_order_relaxed);
+        if (engine_id_ != 0)  engine_->remove_timer(engine_id_);
+        return;
+    }
+
     bool    expected { true };
 
     if (is_armed_.compare_exchange_strong(expected, false,
@@ -91,13 +129,20 @@ set_time_interval(time_type interval_sec, time_type interval_nanosec)  {
 
     // Make sure everything is proper.
     //
-    if (interval_sec <= 0 && interval_nanosec <= 0)
+    if ((interval_sec <= 0 && interval_nanosec <= 0) ||
+        (engine_ &&
+         to_duration_(interval_sec, interval_nanosec) <=
+             engine_type::duration_type::zero()))
         throw std::runtime_error ("TimerAlarm::set_time_interval(): "
                                   "the time interval must be greater then "
                                   "zero nano seconds.");
 
     interval_sec_ = interval_sec;
     interval_nanosec_ = interval_nanosec;
+    if (engine_ && engine_id_ != 0)
+        engine_->set_time_interval(engine_id_,
+                                   to_duration_(interval_sec,
+                                                interval_nanosec));
     return (true);
 }
 
@@ -116,6 +161,34 @@ bool TimerAlarm<F>::arm()  {
 
     repeated_sofar_ = 0;
 
+    if (engine_)  {
+        try  {
+            engine_id_ =
+                engine_->add_timer(
+                    [this]() -> void  {
+                        repeated_sofar_ += 1;
+                        functor_();
+
+                        // In case we just run out of repeat count, disarm.
+                        // The engine gets rid of the timer by itself.
+                        //
+                        if (repeated_sofar_ >= repeat_count_)
+                            is_armed_.store(false,
+                                            std::memory_order_relaxed);
+                    },
+                    to_duration_(interval_sec_, interval_nanosec_),
+                    to_duration_(slack_sec_, slack_nanosec_),
+                    repeat_count_);
+        }
+        catch (...)  {
+            // No timer is behind it, so it is not armed.
+            //
+            is_armed_.store(false, std::memory_order_relaxed);
+            throw;
+        }
+        return (true);
+    }
+
     std::thread engine_thr { &TimerAlarm::engine_routine_, this };
 
     engine_thr.detach();
@@ -127,6 +200,13 @@ bool TimerAlarm<F>::arm()  {
 template<std::invocable F>
 bool TimerAlarm<F>::disarm()  {
 
+    if (engine_)  {
+        is_armed_.store(false, std::memory_order_relaxed);
+        if (engine_id_ != 0)  engine_->remove_timer(engine_id_);
+        engine_id_ = 0;
+        return (true);
+    }
+
     bool    expected { true };
 
     if (! is_armed_.compare_exchange_strong(expected, false,
@@ -197,6 +277,16 @@ template<std::invocable F>
 typename TimerAlarm<F>::size_type TimerAlarm<F>::
 current_repeat_count() const noexcept  { return (repeated_sofar_); }
 
+// ----------------------------------------------------------------------------
+
+template<std::invocable F>
+typename TimerAlarm<F>::engine_type::duration_type TimerAlarm<F>::
+to_duration_(time_type sec, time_type nanosec) noexcept  {
+
+    return (std::chrono::duration_cast<typename engine_type::duration_type>(
+                std::chrono::seconds(sec) + std::chrono::nanoseconds(nanosec)));
+}
+
 } // namespace hmta
 
 // ----------------------------------------------------------------------------
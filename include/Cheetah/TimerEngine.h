@@ -0,0 +1,296 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2023-2028, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the Cheetah nor the
+names of its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <set>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace hmta
+{
+
+// TimerEngine runs any number of timers on one engine_routine thread.
+// Each timer may declare a slack, which is how late it is allowed to go off.
+// Timers whose [deadline, deadline + slack] windows overlap are fired
+// together in one wakeup, instead of each one waking up a thread of its own.
+// It also runs cheap one-shot timeouts (schedule_after()) that are meant
+// to be cancelled, far more often than they go off.
+//
+template<typename CLK = std::chrono::steady_clock>
+class   TimerEngine  {
+
+public:
+
+    using clock_type = CLK;
+    using time_point = typename clock_type::time_point;
+    using duration_type = typename clock_type::duration;
+    using size_type = std::size_t;
+    using id_type = std::size_t;
+    using callback_type = std::function<void()>;
+
+    static constexpr size_type  FOREVER = size_type(-1);
+
+    // Callables up to this size are stored inside the timeout node.
+    // Bigger ones are allocated on the heap.
+    //
+    static constexpr size_type  TIMEOUT_BUF_SIZE = 48;
+
+    // Timeouts are kept at this resolution. They may go off up to one
+    // tick late.
+    //
+    static constexpr duration_type  TIMEOUT_TICK =
+        std::chrono::duration_cast<duration_type>(
+            std::chrono::milliseconds(1));
+
+private:
+
+    struct  Timeout_;
+
+public:
+
+    // It refers to one scheduled timeout. It is cheap to copy. It must
+    // not be used after its engine is destroyed.
+    //
+    class   TimerHandle  {
+
+    public:
+
+        TimerHandle() = default;
+
+        // It returns false if the timeout already went off (or is going
+        // off right now) or was already cancelled.
+        // It is O(1) and doesn't allocate.
+        //
+        bool cancel() noexcept;
+
+        bool is_pending() const noexcept;
+
+    private:
+
+        friend class    TimerEngine;
+
+        TimerHandle(TimerEngine *engine, Timeout_ *node, size_type gen)
+            : engine_ (engine), node_ (node), generation_ (gen)  {   }
+
+        TimerEngine *engine_ { nullptr };
+        Timeout_    *node_ { nullptr };
+        size_type   generation_ { 0 };
+    };
+
+    TimerEngine();
+    TimerEngine(const TimerEngine &) = delete;
+    TimerEngine &operator = (const TimerEngine &) = delete;
+
+    // It must wait for the engine_routine() to finish. Timers that are
+    // still scheduled will not go off.
+    // It must not be called from inside a timer callback.
+    // TimerAlarm instances that run on the engine must be destroyed first.
+    //
+    ~TimerEngine() noexcept;
+
+    // The timer is due first after interval, and then every interval
+    // after that. Each time it may go off up to slack late, but the slack
+    // doesn't shift the schedule. Periods that could not go off within
+    // their slack are skipped.
+    // It returns an id to be used with the other methods.
+    //
+    id_type add_timer(callback_type func,
+                      duration_type interval,
+                      duration_type slack = duration_type::zero(),
+                      size_type repeat_count = FOREVER);
+
+    // If the callback is running on another thread, it waits for it to
+    // finish. It returns false if the timer is already gone.
+    //
+    bool remove_timer(id_type id);
+
+    // After a call to the method, the time interval will change for
+    // the _next_ cycle.
+    //
+    bool set_time_interval(id_type id, duration_type interval);
+
+    size_type timer_count() const;
+
+    // The callable goes off once, after timeout, unless it is cancelled
+    // through the returned handle first.
+    // Nodes come from a pool, so scheduling and cancelling don't allocate,
+    // unless the pool must grow or the callable is bigger than
+    // TIMEOUT_BUF_SIZE.
+    //
+    template<std::invocable C>
+    TimerHandle schedule_after(duration_type timeout, C &&callable);
+
+    // Number of timeouts that are scheduled and not cancelled or gone off
+    //
+    size_type timeout_count() const;
+
+    // Number of times the engine thread woke up, including the times it
+    // had nothing to fire
+    //
+    inline size_type wakeup_count() const noexcept;
+
+    // Number of wakeups that fired nothing
+    //
+    inline size_type empty_wakeup_count() const noexcept;
+
+    // Number of times a timer callback was executed
+    //
+    inline size_type fire_count() const noexcept;
+
+    // Number of wakeups saved by firing coalesced timers together.
+    // It is fire_count() minus wakeup_count(), so the empty wakeups count
+    // against it.
+    //
+    inline size_type saved_wakeups() const noexcept;
+
+private:
+
+    struct  Timer_  {
+
+        callback_type   func;
+        duration_type   interval;
+        duration_type   slack;
+        size_type       repeat_count;
+        size_type       repeated_sofar { 0 };
+        time_point      deadline { };
+        bool            removed { false };
+    };
+
+    // A timeout node lives either on one slot list of the wheel, on the
+    // fired list while its callable runs, or on the free list. Both slot
+    // and fired lists are kept in the order the timeouts go off.
+    //
+    struct  Timeout_  {
+
+        alignas(std::max_align_t) unsigned char buffer[TIMEOUT_BUF_SIZE];
+
+        void        (*invoke)(Timeout_ &) { nullptr };
+        void        (*destroy)(Timeout_ &) { nullptr };
+        Timeout_    *prev { nullptr };
+        Timeout_    *next { nullptr };
+        size_type   expiry_tick { 0 };
+
+        // It changes every time the node leaves the wheel, so stale
+        // handles cannot cancel it.
+        //
+        size_type   generation { 0 };
+    };
+
+    using map_type = std::unordered_map<id_type, Timer_>;
+    using queue_type = std::set<std::pair<time_point, id_type>>;
+    using pool_type = std::vector<std::unique_ptr<Timeout_[]>>;
+
+    static constexpr size_type  WHEEL_SIZE = 1024;  // Must be power of 2
+    static constexpr size_type  POOL_CHUNK_SIZE = 1024;
+    static constexpr size_type  NO_TICK = size_type(-1);
+
+    void engine_routine_() noexcept;
+    void schedule_(id_type id, Timer_ &timer, time_point from);
+    void unschedule_(id_type id, const Timer_ &timer);
+
+    bool cancel_(Timeout_ *node, size_type generation) noexcept;
+    Timeout_ *expire_timeouts_(time_point now) noexcept;
+    Timeout_ *get_timeout_node_();
+    void release_timeout_node_(Timeout_ *node) noexcept;
+    void link_timeout_(Timeout_ *node) noexcept;
+    void unlink_timeout_(Timeout_ *node) noexcept;
+    void refresh_slot_(size_type slot) noexcept;
+
+    template<typename C>
+    static void store_callable_(Timeout_ &node, C &&callable);
+
+    inline size_type tick_of_(time_point tp) const noexcept;
+    inline time_point time_of_(size_type tick) const noexcept;
+
+    map_type                timers_ { };
+    queue_type              by_deadline_ { };  // Earliest it may go off
+    queue_type              by_limit_ { };     // Latest it may go off
+    id_type                 next_id_ { 1 };
+    id_type                 running_id_ { 0 }; // 0 means none is running
+    bool                    stop_ { false };
+
+    const time_point        epoch_ { clock_type::now() };
+    time_point              wake_at_ { time_point::max() };
+    Timeout_                *wheel_[WHEEL_SIZE] { };
+    Timeout_                *wheel_tail_[WHEEL_SIZE] { };
+
+    // The earliest expiry in each slot. A slot also holds timeouts of later
+    // turns of the wheel, so this is what tells when the slot is due.
+    // It is dirty, when its earliest timeout was cancelled.
+    //
+    size_type               slot_expiry_[WHEEL_SIZE];
+    bool                    slot_dirty_[WHEEL_SIZE] { };
+    Timeout_                *free_timeouts_ { nullptr };
+    pool_type               timeout_pool_ { };
+    size_type               processed_tick_ { 0 };
+    size_type               next_timeout_tick_ { NO_TICK };
+    size_type               timeout_count_ { 0 };
+
+    std::atomic<size_type>  wakeups_ { 0 };
+    std::atomic<size_type>  empty_wakeups_ { 0 };
+    std::atomic<size_type>  fires_ { 0 };
+
+    mutable std::mutex      state_mutex_ { };
+    std::condition_variable engine_cv_ { };
+    std::condition_variable done_cv_ { };
+    std::thread             engine_thr_ { };
+};
+
+} // namespace hmta
+
+// ----------------------------------------------------------------------------
+
+#  ifndef HMTA_DO_NOT_INCLUDE_TCC_FILES
+#    include <Cheetah/TimerEngine.tcc>
+#  endif // HMTA_DO_NOT_INCLUDE_TCC_FILES
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,669 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2023-2028, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the Cheetah nor the
+names of its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <Cheetah/TimerEngine.h>
+
+#include <stdexcept>
+
+// ----------------------------------------------------------------------------
+
+namespace hmta
+{
+
+template<typename CLK>
+TimerEngine<CLK>::TimerEngine()  {
+
+    std::fill(std::begin(slot_expiry_), std::end(slot_expiry_), NO_TICK);
+    engine_thr_ = std::thread { &TimerEngine::engine_routine_, this };
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+TimerEngine<CLK>::~TimerEngine() noexcept  {
+
+    {
+        const std::lock_guard<std::mutex>   guard { state_mutex_ };
+
+        // Let the engine_routine() know it is time to quit.
+        //
+        stop_ = true;
+        engine_cv_.notify_one();
+    }
+
+    // We must wait for the engine_routine() to finish.
+    //
+    engine_thr_.join();
+
+    // Get rid of the callables of the timeouts that never went off.
+    //
+    for (Timeout_ *head : wheel_)
+        for (Timeout_ *node = head; node != nullptr; node = node->next)
+            node->destroy(*node);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::id_type TimerEngine<CLK>::
+add_timer(callback_type func,
+          duration_type interval,
+          duration_type slack,
+          size_type repeat_count)  {
+
+    // Make sure everything is proper.
+    //
+    if (repeat_count == 0)
+        throw std::runtime_error ("TimerEngine::add_timer(): "
+                                  "repeat count must be greater then zero.");
+    if (interval <= duration_type::zero())
+        throw std::runtime_error { "TimerEngine::add_timer(): "
+                                   "the time interval must be greater then "
+                                   "zero nano seconds." };
+    if (slack < duration_type::zero())
+        throw std::runtime_error { "TimerEngine::add_timer(): "
+                                   "the slack must not be negative." };
+
+    const std::lock_guard<std::mutex>   guard { state_mutex_ };
+    const id_type                       id { next_id_++ };
+    Timer_                              &timer =
+        timers_.emplace(id,
+                        Timer_ { std::move(func),
+                                 interval,
+                                 slack,
+                                 repeat_count }).first->second;
+
+    schedule_(id, timer, clock_type::now());
+
+    // Only wake up the engine, if it must now wake up sooner than planned.
+    //
+    if (timer.deadline + timer.slack < wake_at_)
+        engine_cv_.notify_one();
+    return (id);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+template<std::invocable C>
+typename TimerEngine<CLK>::TimerHandle TimerEngine<CLK>::
+schedule_after(duration_type timeout, C &&callable)  {
+
+    if (timeout < duration_type::zero())
+        throw std::runtime_error { "TimerEngine::schedule_after(): "
+                                   "the timeout must not be negative." };
+
+    // The first tick that starts at or after the deadline
+    //
+    const duration_type since_epoch { clock_type::now() - epoch_ + timeout };
+    size_type           expiry {
+        size_type((since_epoch + TIMEOUT_TICK - duration_type(1)) /
+                  TIMEOUT_TICK) };
+
+    const std::lock_guard<std::mutex>   guard { state_mutex_ };
+    Timeout_                            *node = get_timeout_node_();
+
+    try  {
+        store_callable_(*node, std::forward<C>(callable));
+    }
+    catch (...)  {
+        node->next = free_timeouts_;
+        free_timeouts_ = node;
+        throw;
+    }
+
+    // The engine is done with the ticks up to processed_tick_
+    //
+    if (expiry <= processed_tick_)  expiry = processed_tick_ + 1;
+    node->expiry_tick = expiry;
+    link_timeout_(node);
+    timeout_count_ += 1;
+
+    if (expiry < next_timeout_tick_)  {
+        next_timeout_tick_ = expiry;
+
+        // Only wake up the engine, if it must now wake up sooner than
+        // planned.
+        //
+        if (time_of_(expiry) < wake_at_)
+            engine_cv_.notify_one();
+    }
+    return (TimerHandle { this, node, node->generation });
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+bool TimerEngine<CLK>::TimerHandle::cancel() noexcept  {
+
+    return (engine_ != nullptr && engine_->cancel_(node_, generation_));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+bool TimerEngine<CLK>::TimerHandle::is_pending() const noexcept  {
+
+    if (engine_ == nullptr)  return (false);
+
+    const std::lock_guard<std::mutex>   guard { engine_->state_mutex_ };
+
+    return (node_->generation == generation_);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+bool TimerEngine<CLK>::remove_timer(id_type id)  {
+
+    std::unique_lock<std::mutex>    guard { state_mutex_ };
+    auto                            iter = timers_.find(id);
+
+    if (iter == timers_.end())  return (false);
+
+    if (running_id_ == id)  {
+        // A callback removing its own timer. The engine_routine() will
+        // get rid of it, once the callback returns.
+        //
+        if (std::this_thread::get_id() == engine_thr_.get_id())  {
+            iter->second.removed = true;
+            return (true);
+        }
+
+        done_cv_.wait(guard, [this, id]() { return (running_id_ != id); });
+
+        // It might have run out of repeat count, while we were waiting.
+        //
+        iter = timers_.find(id);
+        if (iter == timers_.end())  return (true);
+    }
+
+    unschedule_(id, iter->second);
+    timers_.erase(iter);
+    return (true);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+bool TimerEngine<CLK>::
+set_time_interval(id_type id, duration_type interval)  {
+
+    const std::lock_guard<std::mutex>   guard { state_mutex_ };
+
+    // Make sure everything is proper.
+    //
+    if (interval <= duration_type::zero())
+        throw std::runtime_error ("TimerEngine::set_time_interval(): "
+                                  "the time interval must be greater then "
+                                  "zero nano seconds.");
+
+    const auto  iter = timers_.find(id);
+
+    if (iter == timers_.end())  return (false);
+
+    iter->second.interval = interval;
+    return (true);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::size_type
+TimerEngine<CLK>::timer_count() const  {
+
+    const std::lock_guard<std::mutex>   guard { state_mutex_ };
+
+    return (timers_.size());
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::size_type
+TimerEngine<CLK>::timeout_count() const  {
+
+    const std::lock_guard<std::mutex>   guard { state_mutex_ };
+
+    return (timeout_count_);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::size_type
+TimerEngine<CLK>::wakeup_count() const noexcept  {
+
+    return (wakeups_.load(std::memory_order_relaxed));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::size_type
+TimerEngine<CLK>::empty_wakeup_count() const noexcept  {
+
+    return (empty_wakeups_.load(std::memory_order_relaxed));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::size_type
+TimerEngine<CLK>::fire_count() const noexcept  {
+
+    return (fires_.load(std::memory_order_relaxed));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::size_type
+TimerEngine<CLK>::saved_wakeups() const noexcept  {
+
+    const size_type wakeups { wakeups_.load(std::memory_order_relaxed) };
+    const size_type fires { fires_.load(std::memory_order_relaxed) };
+
+    return (fires > wakeups ? fires - wakeups : 0);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+void TimerEngine<CLK>::
+schedule_(id_type id, Timer_ &timer, time_point from)  {
+
+    timer.deadline = from + timer.interval;
+    by_deadline_.emplace(timer.deadline, id);
+    by_limit_.emplace(timer.deadline + timer.slack, id);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+void TimerEngine<CLK>::unschedule_(id_type id, const Timer_ &timer)  {
+
+    by_deadline_.erase({ timer.deadline, id });
+    by_limit_.erase({ timer.deadline + timer.slack, id });
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+bool TimerEngine<CLK>::
+cancel_(Timeout_ *node, size_type generation) noexcept  {
+
+    const std::lock_guard<std::mutex>   guard { state_mutex_ };
+
+    if (node->generation != generation)  return (false);
+
+    const size_type slot { node->expiry_tick & (WHEEL_SIZE - 1) };
+
+    // We leave next_timeout_tick_ alone. It is only a lower bound.
+    // The slot's earliest expiry is found again, before it is needed.
+    //
+    unlink_timeout_(node);
+    if (wheel_[slot] == nullptr)  {
+        slot_expiry_[slot] = NO_TICK;
+        slot_dirty_[slot] = false;
+    }
+    else if (node->expiry_tick == slot_expiry_[slot])
+        slot_dirty_[slot] = true;
+    timeout_count_ -= 1;
+    release_timeout_node_(node);
+    return (true);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::Timeout_ *TimerEngine<CLK>::
+expire_timeouts_(time_point now) noexcept  {
+
+    const size_type now_tick { tick_of_(now) };
+    Timeout_        *fired { nullptr };
+    Timeout_        *fired_tail { nullptr };
+
+    if (next_timeout_tick_ == NO_TICK || next_timeout_tick_ > now_tick)
+        return (fired);
+
+    // Sweep the ticks that passed since the last time in order, so the
+    // timeouts fire in tick order and then in scheduling order. Every
+    // expiry is past processed_tick_, so at each tick only the timeouts of
+    // exactly that tick are due. If the engine was held up for more than
+    // one turn of the wheel, it goes around more than once.
+    // Nothing is due before next_timeout_tick_.
+    //
+    for (size_type tick = std::max(processed_tick_ + 1, next_timeout_tick_);
+         tick <= now_tick; ++tick)  {
+        const size_type slot { tick & (WHEEL_SIZE - 1) };
+        Timeout_        *node = wheel_[slot];
+
+        // Nothing in this slot is due on this turn of the wheel. A dirty
+        // slot_expiry_ is still a lower bound.
+        //
+        if (slot_expiry_[slot] > tick)  continue;
+
+        while (node != nullptr)  {
+            Timeout_    *next = node->next;
+
+            if (node->expiry_tick <= tick)  {
+                unlink_timeout_(node);
+                timeout_count_ -= 1;
+
+                // From here on, its handles cannot cancel it.
+                //
+                node->generation += 1;
+                if (fired_tail != nullptr)
+                    fired_tail->next = node;
+                else
+                    fired = node;
+                fired_tail = node;
+            }
+            node = next;
+        }
+        refresh_slot_(slot);
+    }
+    processed_tick_ = now_tick;
+
+    // Wake up next for the earliest timeout that is actually scheduled,
+    // not for a slot that only holds timeouts of later turns.
+    //
+    next_timeout_tick_ = NO_TICK;
+    if (timeout_count_ > 0)
+        for (size_type slot = 0; slot < WHEEL_SIZE; ++slot)  {
+            if (slot_dirty_[slot])  refresh_slot_(slot);
+            next_timeout_tick_ =
+                std::min(next_timeout_tick_, slot_expiry_[slot]);
+        }
+
+    return (fired);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+void TimerEngine<CLK>::refresh_slot_(size_type slot) noexcept  {
+
+    size_type   expiry { NO_TICK };
+
+    for (Timeout_ *node = wheel_[slot]; node != nullptr; node = node->next)
+        expiry = std::min(expiry, node->expiry_tick);
+    slot_expiry_[slot] = expiry;
+    slot_dirty_[slot] = false;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::Timeout_ *
+TimerEngine<CLK>::get_timeout_node_()  {
+
+    if (free_timeouts_ == nullptr)  {
+        // Own the chunk first, so it is not leaked if the pool cannot grow.
+        //
+        auto        new_chunk = std::make_unique<Timeout_[]>(POOL_CHUNK_SIZE);
+        Timeout_    *chunk = new_chunk.get();
+
+        timeout_pool_.push_back(std::move(new_chunk));
+
+        for (size_type i = 0; i < POOL_CHUNK_SIZE; ++i)  {
+            chunk[i].next = free_timeouts_;
+            free_timeouts_ = chunk + i;
+        }
+    }
+
+    Timeout_    *node = free_timeouts_;
+
+    free_timeouts_ = node->next;
+    return (node);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+void TimerEngine<CLK>::release_timeout_node_(Timeout_ *node) noexcept  {
+
+    node->destroy(*node);
+    node->invoke = nullptr;
+    node->destroy = nullptr;
+    node->generation += 1;
+    node->prev = nullptr;
+    node->next = free_timeouts_;
+    free_timeouts_ = node;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+void TimerEngine<CLK>::link_timeout_(Timeout_ *node) noexcept  {
+
+    const size_type slot { node->expiry_tick & (WHEEL_SIZE - 1) };
+    Timeout_        *&tail = wheel_tail_[slot];
+
+    // Append, so the slot stays in scheduling order.
+    //
+    node->prev = tail;
+    node->next = nullptr;
+    if (tail != nullptr)
+        tail->next = node;
+    else
+        wheel_[slot] = node;
+    tail = node;
+    slot_expiry_[slot] = std::min(slot_expiry_[slot], node->expiry_tick);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+void TimerEngine<CLK>::unlink_timeout_(Timeout_ *node) noexcept  {
+
+    const size_type slot { node->expiry_tick & (WHEEL_SIZE - 1) };
+
+    if (node->prev != nullptr)
+        node->prev->next = node->next;
+    else
+        wheel_[slot] = node->next;
+    if (node->next != nullptr)
+        node->next->prev = node->prev;
+    else
+        wheel_tail_[slot] = node->prev;
+    node->prev = nullptr;
+    node->next = nullptr;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+template<typename C>
+void TimerEngine<CLK>::store_callable_(Timeout_ &node, C &&callable)  {
+
+    using value_type = std::decay_t<C>;
+
+    if constexpr (sizeof(value_type) <= TIMEOUT_BUF_SIZE &&
+                  alignof(value_type) <= alignof(std::max_align_t))  {
+        ::new (static_cast<void *>(node.buffer))
+            value_type(std::forward<C>(callable));
+        node.invoke = [](Timeout_ &n) -> void  {
+            (*std::launder(reinterpret_cast<value_type *>(n.buffer)))();
+        };
+        node.destroy = [](Timeout_ &n) -> void  {
+            std::launder(reinterpret_cast<value_type *>(n.buffer))->
+                ~value_type();
+        };
+    }
+    else  {
+        value_type  *ptr = new value_type(std::forward<C>(callable));
+
+        ::new (static_cast<void *>(node.buffer)) value_type *(ptr);
+        node.invoke = [](Timeout_ &n) -> void  {
+            (**std::launder(reinterpret_cast<value_type **>(n.buffer)))();
+        };
+        node.destroy = [](Timeout_ &n) -> void  {
+            delete *std::launder(reinterpret_cast<value_type **>(n.buffer));
+        };
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::size_type
+TimerEngine<CLK>::tick_of_(time_point tp) const noexcept  {
+
+    return (size_type((tp - epoch_) / TIMEOUT_TICK));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+typename TimerEngine<CLK>::time_point
+TimerEngine<CLK>::time_of_(size_type tick) const noexcept  {
+
+    return (epoch_ + TIMEOUT_TICK * typename duration_type::rep(tick));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename CLK>
+void TimerEngine<CLK>::engine_routine_() noexcept  {
+
+    std::unique_lock<std::mutex>    guard { state_mutex_ };
+    std::vector<id_type>            due;
+    bool                            idle_wakeup { false };
+
+    while (! stop_)  {
+        // Sleep until the latest time the most urgent timer may go off.
+        // Everything else that is due by then rides on the same wakeup.
+        //
+        time_point  wake_at { time_point::max() };
+
+        if (! by_limit_.empty())
+            wake_at = by_limit_.begin()->first;
+        if (next_timeout_tick_ != NO_TICK &&
+            time_of_(next_timeout_tick_) < wake_at)
+            wake_at = time_of_(next_timeout_tick_);
+
+        if (wake_at == time_point::max() || clock_type::now() < wake_at)  {
+            // We woke up last time, but had nothing to fire.
+            //
+            if (idle_wakeup)
+                empty_wakeups_.fetch_add(1, std::memory_order_relaxed);
+
+            wake_at_ = wake_at;
+            if (wake_at == time_point::max())
+                engine_cv_.wait(guard);
+            else
+                engine_cv_.wait_until(guard, wake_at);
+            wake_at_ = time_point::max();
+
+            if (! stop_)  {
+                wakeups_.fetch_add(1, std::memory_order_relaxed);
+                idle_wakeup = true;
+            }
+            continue;
+        }
+
+        const time_point    now { clock_type::now() };
+        Timeout_            *fired = expire_timeouts_(now);
+
+        due.clear();
+        while (! by_deadline_.empty() && by_deadline_.begin()->first <= now)  {
+            const id_type   id { by_deadline_.begin()->second };
+
+            unschedule_(id, timers_.find(id)->second);
+            due.push_back(id);
+        }
+        if (! due.empty() || fired != nullptr)
+            idle_wakeup = false;
+
+        if (fired != nullptr)  {
+            guard.unlock();
+            for (Timeout_ *node = fired; node != nullptr; node = node->next)  {
+                fires_.fetch_add(1, std::memory_order_relaxed);
+                node->invoke(*node);
+            }
+            guard.lock();
+            while (fired != nullptr)  {
+                Timeout_    *next = fired->next;
+
+                release_timeout_node_(fired);
+                fired = next;
+            }
+        }
+
+        for (const id_type id : due)  {
+            const auto  iter = timers_.find(id);
+
+            // It was removed by an earlier callback in this batch.
+            //
+            if (iter == timers_.end())  continue;
+
+            Timer_  &timer = iter->second;
+
+            running_id_ = id;
+            timer.repeated_sofar += 1;
+            fires_.fetch_add(1, std::memory_order_relaxed);
+            guard.unlock();
+            timer.func();
+            guard.lock();
+            running_id_ = 0;
+
+            if (timer.removed || timer.repeated_sofar >= timer.repeat_count)  {
+                timers_.erase(id);
+            }
+            else  {
+                // Stay on the nominal schedule, so the slack doesn't add up
+                // over the periods. Skip the periods that can no longer go
+                // off within their slack. Earlier callbacks in this batch
+                // may have taken a while, so don't go by the wakeup time.
+                //
+                const time_point    after { clock_type::now() };
+                time_point          from { timer.deadline };
+
+                if (from + timer.interval + timer.slack < after)
+                    from += timer.interval *
+                            ((after - from - timer.interval - timer.slack) /
+                             timer.interval + 1);
+                schedule_(id, timer, from);
+            }
+            done_cv_.notify_all();
+        }
+    }
+}
+
+} // namespace hmta
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
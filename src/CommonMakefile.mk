@@ -13,12 +13,16 @@ PROJECT_INCLUDE_DIR = ../../include
 SRCS = ../test/thrpool_tester.cc
 
 HEADERS = $(LOCAL_INCLUDE_DIR)/Cheetah/TimerAlarm.h \
-          $(LOCAL_INCLUDE_DIR)/Cheetah/TimerAlarm.tcc
+          $(LOCAL_INCLUDE_DIR)/Cheetah/TimerAlarm.tcc \
+          $(LOCAL_INCLUDE_DIR)/Cheetah/TimerEngine.h \
+          $(LOCAL_INCLUDE_DIR)/Cheetah/TimerEngine.tcc
 
 LIB_NAME =
 TARGET_LIB =
 
 TARGETS += $(LOCAL_BIN_DIR)/timer_tester \
+           $(LOCAL_BIN_DIR)/timer_engine_tester \
+           $(LOCAL_BIN_DIR)/timeout_bench \
            $(LOCAL_BIN_DIR)/lru_lfu_caches
 
 # -----------------------------------------------------------------------------
@@ -71,6 +75,14 @@ TIMER_TESTER_OBJ = $(LOCAL_OBJ_DIR)/timer_tester.o
 $(LOCAL_BIN_DIR)/timer_tester: $(TARGET_LIB) $(TIMER_TESTER_OBJ)
 	$(CXX) -o $@ $(TIMER_TESTER_OBJ) $(LIBS)
 
+TIMER_ENGINE_TESTER_OBJ = $(LOCAL_OBJ_DIR)/timer_engine_tester.o
+$(LOCAL_BIN_DIR)/timer_engine_tester: $(TARGET_LIB) $(TIMER_ENGINE_TESTER_OBJ)
+	$(CXX) -o $@ $(TIMER_ENGINE_TESTER_OBJ) $(LIBS)
+
+TIMEOUT_BENCH_OBJ = $(LOCAL_OBJ_DIR)/timeout_bench.o
+$(LOCAL_BIN_DIR)/timeout_bench: $(TARGET_LIB) $(TIMEOUT_BENCH_OBJ)
+	$(CXX) -o $@ $(TIMEOUT_BENCH_OBJ) $(LIBS)
+
 LRU_LFU_CACHES_OBJ = $(LOCAL_OBJ_DIR)/lru_lfu_caches.o
 $(LOCAL_BIN_DIR)/lru_lfu_caches: $(TARGET_LIB) $(LRU_LFU_CACHES_OBJ)
 	$(CXX) -o $@ $(LRU_LFU_CACHES_OBJ) $(LIBS)
@@ -81,10 +93,14 @@ depend:
 	makedepend $(CXXFLAGS) -Y $(SRCS)
 
 clean:
-	rm -f $(LIB_OBJS) $(TARGETS) $(TIMER_TESTER_OBJ) $(LRU_LFU_CACHES_OBJ)
+	rm -f $(LIB_OBJS) $(TARGETS) $(TIMER_TESTER_OBJ) \
+	      $(TIMER_ENGINE_TESTER_OBJ) $(TIMEOUT_BENCH_OBJ) \
+	      $(LRU_LFU_CACHES_OBJ)
 
 clobber:
-	rm -f $(LIB_OBJS) $(TARGETS) $(TIMER_TESTER_OBJ) $(LRU_LFU_CACHES_OBJ)
+	rm -f $(LIB_OBJS) $(TARGETS) $(TIMER_TESTER_OBJ) \
+	      $(TIMER_ENGINE_TESTER_OBJ) $(TIMEOUT_BENCH_OBJ) \
+	      $(LRU_LFU_CACHES_OBJ)
 
 install_lib:
 	cp -pf $(TARGET_LIB) $(PROJECT_LIB_DIR)/.
@@ -0,0 +1,459 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2023-2028, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the Cheetah nor the
+names of its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <Cheetah/TimerAlarm.h>
+#include <Cheetah/TimerEngine.h>
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace hmta;
+using namespace std::chrono_literals;
+
+// ----------------------------------------------------------------------------
+
+class   MyFoot  {
+
+public:
+
+    bool operator () ()  {
+
+        count_ += 1;
+        return (true);
+    }
+
+    size_t count() const  { return (count_.load()); }
+
+private:
+
+    std::atomic<size_t> count_ { 0 };
+};
+
+// ----------------------------------------------------------------------------
+
+static void test_coalescing()  {
+
+    std::cout << "\nTesting coalescing ..." << std::endl;
+
+    TimerEngine<>                   engine;
+    std::atomic<size_t>             counts[10] { };
+    TimerEngine<>::id_type          ids[10];
+
+    // 10 timers, added 5ms apart, all with a 100ms interval and a 60ms
+    // slack. Their windows overlap, so they must share wakeups.
+    //
+    for (size_t i = 0; i < 10; ++i)  {
+        ids[i] = engine.add_timer([&counts, i]() -> void { counts[i] += 1; },
+                                  100ms, 60ms);
+        std::this_thread::sleep_for(5ms);
+    }
+    std::this_thread::sleep_for(1s);
+
+    for (size_t i = 0; i < 10; ++i)  {
+        assert(counts[i] >= 5);
+        assert(engine.remove_timer(ids[i]));
+        assert(! engine.remove_timer(ids[i]));
+    }
+    assert(engine.timer_count() == 0);
+
+    std::cout << "Fires: " << engine.fire_count()
+              << ", Wakeups: " << engine.wakeup_count()
+              << ", Empty wakeups: " << engine.empty_wakeup_count()
+              << ", Saved wakeups: " << engine.saved_wakeups() << std::endl;
+    assert(engine.fire_count() ==
+           engine.wakeup_count() + engine.saved_wakeups());
+    assert(engine.saved_wakeups() > engine.wakeup_count());
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_no_slack()  {
+
+    std::cout << "\nTesting no slack ..." << std::endl;
+
+    TimerEngine<>       engine;
+    std::atomic<size_t> count1 { 0 };
+    std::atomic<size_t> count2 { 0 };
+
+    // Without slack, the timers that are apart must not share a wakeup.
+    // They stay on their nominal schedules 250ms apart, so only a wakeup
+    // that is 250ms late could fire both.
+    //
+    engine.add_timer([&count1]() -> void { count1 += 1; }, 500ms, 0ms, 3);
+    std::this_thread::sleep_for(250ms);
+    engine.add_timer([&count2]() -> void { count2 += 1; }, 500ms, 0ms, 3);
+    std::this_thread::sleep_for(2000ms);
+
+    assert(count1 == 3);
+    assert(count2 == 3);
+    assert(engine.timer_count() == 0);
+    assert(engine.wakeup_count() - engine.empty_wakeup_count() == 6);
+    assert(engine.saved_wakeups() == 0);
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_slack_keeps_schedule()  {
+
+    std::cout << "\nTesting slack keeps the schedule ..." << std::endl;
+
+    TimerEngine<>       engine;
+    std::atomic<size_t> count { 0 };
+
+    // A lone timer goes off at the end of its slack every time. That
+    // must not add the slack to its interval.
+    //
+    engine.add_timer([&count]() -> void { count += 1; }, 100ms, 50ms);
+    std::this_thread::sleep_for(1500ms);
+
+    std::cout << "Fires: " << count << std::endl;
+    assert(count >= 13 && count <= 15);
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_slow_batch()  {
+
+    std::cout << "\nTesting a slow callback in the same batch ..."
+              << std::endl;
+
+    using time_point = TimerEngine<>::time_point;
+
+    TimerEngine<>           engine;
+    std::mutex              times_mutex;
+    std::vector<time_point> times;
+
+    // Both are due at the same wakeup. The first one holds up the
+    // second for a few of its periods. Those periods must be skipped,
+    // not fired later than their slack.
+    //
+    engine.add_timer([]() -> void  {
+                         std::this_thread::sleep_for(360ms);
+                     },
+                     100ms, 0ms, 1);
+
+    const time_point    start { TimerEngine<>::clock_type::now() };
+    const auto          id =
+        engine.add_timer([&times_mutex, &times]() -> void  {
+                             const std::lock_guard<std::mutex>   guard {
+                                 times_mutex };
+
+                             times.push_back(TimerEngine<>::clock_type::now());
+                         },
+                         100ms, 10ms);
+
+    std::this_thread::sleep_for(800ms);
+    engine.remove_timer(id);
+
+    const std::lock_guard<std::mutex>   guard { times_mutex };
+
+    // The first one went off late, because of the slow callback. The
+    // others must be within their slack (and some scheduling delay) of
+    // a period.
+    //
+    assert(times.size() >= 3);
+    for (size_t i = 1; i < times.size(); ++i)
+        assert((times[i] - start) % 100ms < 35ms);
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_self_removal()  {
+
+    std::cout << "\nTesting self removal ..." << std::endl;
+
+    TimerEngine<>                       engine;
+    std::atomic<size_t>                 count { 0 };
+    std::atomic<TimerEngine<>::id_type> id { 0 };
+
+    id = engine.add_timer([&engine, &count, &id]() -> void  {
+                              if (++count == 2)  engine.remove_timer(id);
+                          },
+                          20ms);
+    std::this_thread::sleep_for(200ms);
+
+    assert(count == 2);
+    assert(engine.timer_count() == 0);
+
+    try  {
+        engine.add_timer([]() -> void { }, 0ms);
+        std::cout << "We must get an exception here" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    catch (const std::runtime_error &) { ; }
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_timer_alarm()  {
+
+    std::cout << "\nTesting TimerAlarm on an engine ..." << std::endl;
+
+    TimerEngine<>       engine;
+    MyFoot              foot_master;
+    MyFoot              foot_master2;
+
+    // Every 100ms, 50ms slack, go off only 5 times.
+    //
+    TimerAlarm<MyFoot>  timer (foot_master, engine, 0, 100000000, 5,
+                               0, 50000000);
+    // Every 100ms, 50ms slack, forever.
+    //
+    TimerAlarm<MyFoot>  timer2 (foot_master2, engine, 0, 100000000,
+                                TimerAlarm<MyFoot>::FOREVER, 0, 50000000);
+
+    timer.arm();
+    timer2.arm();
+    assert(timer.is_armed());
+    std::this_thread::sleep_for(1s);
+
+    assert(foot_master.count() == 5);
+    assert(timer.current_repeat_count() == 5);
+    assert(! timer.is_armed());
+    assert(timer2.is_armed());
+
+    timer2.disarm();
+    assert(! timer2.is_armed());
+
+    const size_t    count2 = foot_master2.count();
+
+    assert(count2 >= 5);
+    std::this_thread::sleep_for(300ms);
+    assert(foot_master2.count() == count2);
+    assert(engine.timer_count() == 0);
+    assert(engine.saved_wakeups() > 0);
+
+    // A rejected interval must leave the timer able to arm again.
+    //
+    try  {
+        timer2.set_time_interval(1, -1500000000);
+        std::cout << "We must get an exception here" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    catch (const std::runtime_error &) { ; }
+    timer2.arm();
+    assert(timer2.is_armed());
+    timer2.disarm();
+
+    try  {
+        TimerAlarm<MyFoot>  timer3 (foot_master, engine, 1, 0, 5, -1);
+
+        std::cout << "We must get an exception here" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    catch (const std::runtime_error &) { ; }
+
+    // Negative, once seconds and nano-seconds are added up
+    //
+    try  {
+        TimerAlarm<MyFoot>  timer4 (foot_master, engine, 1, -1500000000);
+
+        std::cout << "We must get an exception here" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    catch (const std::runtime_error &) { ; }
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_timeouts()  {
+
+    std::cout << "\nTesting timeouts ..." << std::endl;
+
+    std::atomic<size_t>             count { 0 };
+    const auto                      tracker = std::make_shared<int>(0);
+    std::vector<char>               big (1000, 'x');
+
+    {
+        TimerEngine<>                           engine;
+        std::vector<TimerEngine<>::TimerHandle> handles;
+
+        // Half of them are cancelled, the other half must go off.
+        //
+        for (size_t i = 0; i < 10000; ++i)
+            handles.push_back(engine.schedule_after(
+                std::chrono::milliseconds(200 + i % 50),
+                [&count]() -> void { count += 1; }));
+        assert(engine.timeout_count() == 10000);
+        for (size_t i = 0; i < 10000; i += 2)
+            assert(handles[i].cancel());
+        assert(engine.timeout_count() == 5000);
+        assert(! handles[0].cancel());
+        assert(! handles[0].is_pending());
+        assert(handles[1].is_pending());
+        assert(! TimerEngine<>::TimerHandle { }.cancel());
+
+        // Too big for the node buffer
+        //
+        const auto  handle =
+            engine.schedule_after(
+                200ms,
+                [&count, big]() -> void { count += big.size(); });
+
+        std::this_thread::sleep_for(500ms);
+        assert(count == 5000 + 1000);
+        assert(engine.timeout_count() == 0);
+        assert(! handle.is_pending());
+        assert(! handles[1].cancel());
+        assert(engine.saved_wakeups() > 0);
+
+        // Nodes that went off are reused. Stale handles must not cancel
+        // their new timeouts.
+        //
+        const auto  handle2 =
+            engine.schedule_after(
+                1h,
+                [tracker]() -> void { *tracker += 1; });
+
+        assert(! handles[1].cancel());
+        assert(handle2.is_pending());
+        assert(tracker.use_count() == 2);
+        engine.schedule_after(0ms, [&count]() -> void { count += 1; });
+        std::this_thread::sleep_for(20ms);
+        assert(count == 5000 + 1000 + 1);
+    }
+
+    // The engine must get rid of the callables that never went off.
+    //
+    assert(tracker.use_count() == 1);
+    assert(*tracker == 0);
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_idle_timeouts()  {
+
+    std::cout << "\nTesting wakeups with long timeouts pending ..."
+              << std::endl;
+
+    TimerEngine<>       engine;
+    std::atomic<size_t> count { 0 };
+
+    // Long timeouts fill many slots of the wheel. None of them is due on
+    // this turn of the wheel, so they must not wake up the engine.
+    //
+    for (size_t i = 0; i < 2000; ++i)  {
+        engine.schedule_after(30s, [&count]() -> void { count += 1; });
+        std::this_thread::sleep_for(50us);
+    }
+    engine.schedule_after(5ms, [&count]() -> void { count += 1; });
+    std::this_thread::sleep_for(1s);
+
+    std::cout << "Wakeups: " << engine.wakeup_count()
+              << ", Empty wakeups: " << engine.empty_wakeup_count()
+              << std::endl;
+    assert(count == 1);
+    assert(engine.timeout_count() == 2000);
+    assert(engine.wakeup_count() <= 5);
+}
+
+// ----------------------------------------------------------------------------
+
+static void test_timeout_order()  {
+
+    std::cout << "\nTesting timeout order ..." << std::endl;
+
+    TimerEngine<>       engine;
+    std::mutex          order_mutex;
+    std::vector<size_t> order;
+    const auto          record = [&order_mutex, &order](size_t n) -> void  {
+        const std::lock_guard<std::mutex>   guard { order_mutex };
+
+        order.push_back(n);
+    };
+
+    // Keep the engine busy, so all of the timeouts below are due by the
+    // time it sweeps.
+    //
+    engine.schedule_after(1ms,
+                          []() -> void  {
+                              std::this_thread::sleep_for(30ms);
+                          });
+    std::this_thread::sleep_for(5ms);
+    for (size_t n = 1; n <= 10; ++n)
+        engine.schedule_after(std::chrono::milliseconds(n),
+                              [&record, n]() -> void { record(n); });
+    std::this_thread::sleep_for(50ms);
+
+    // Now hold it up for more than one turn of the wheel
+    //
+    engine.schedule_after(1ms,
+                          []() -> void  {
+                              std::this_thread::sleep_for(1200ms);
+                          });
+    std::this_thread::sleep_for(5ms);
+
+    // Same timeout, so they must fire in scheduling order
+    //
+    for (size_t n = 11; n <= 15; ++n)
+        engine.schedule_after(10ms, [&record, n]() -> void { record(n); });
+    for (size_t n = 16; n <= 20; ++n)
+        engine.schedule_after(std::chrono::milliseconds(n),
+                              [&record, n]() -> void { record(n); });
+    engine.schedule_after(1050ms, [&record]() -> void { record(21); });
+    engine.schedule_after(1100ms, [&record]() -> void { record(22); });
+    std::this_thread::sleep_for(1500ms);
+
+    const std::lock_guard<std::mutex>   guard { order_mutex };
+
+    assert(order.size() == 22);
+    for (size_t i = 0; i < order.size(); ++i)
+        assert(order[i] == i + 1);
+}
+
+// ----------------------------------------------------------------------------
+
+int main(int, char *[])  {
+
+    test_coalescing();
+    test_no_slack();
+    test_slack_keeps_schedule();
+    test_slow_batch();
+    test_self_removal();
+    test_timer_alarm();
+    test_timeouts();
+    test_idle_timeouts();
+    test_timeout_order();
+    return (EXIT_SUCCESS);
+}
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End: